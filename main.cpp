@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <vector>
 #include <filesystem>
+#include <numeric>
 
 namespace fs = std::filesystem;
 
@@ -20,12 +21,14 @@ std::vector<Task> read_tasks() {
 
         while (std::getline(file, line)) {
             std::stringstream ss(line);
-            std::string name, start_str, end_str, elapsed_str, date_str;
+            std::string name, start_str, end_str, elapsed_str, date_str, project_str, tags_str;
             std::getline(ss, name, ',');
             std::getline(ss, start_str, ',');
             std::getline(ss, end_str, ',');
             std::getline(ss, elapsed_str, ',');
             std::getline(ss, date_str, ',');
+            std::getline(ss, project_str, ','); // Absent in files written before tags existed
+            std::getline(ss, tags_str, ',');
 
             Task task;
             task.name = name;
@@ -45,11 +48,17 @@ std::vector<Task> read_tasks() {
 
             task.elapsed_seconds = elapsed_str.empty() ? 0 : std::stoll(elapsed_str);
             task.date = date_str;
+            task.project = project_str;
+
+            std::stringstream tag_stream(tags_str);
+            for (std::string tag; std::getline(tag_stream, tag, ';');) {
+                if (!tag.empty()) task.tags.push_back(tag);
+            }
             tasks.push_back(task);
         }
     } else {
         if (std::ofstream new_file(FILE_PATH); new_file.is_open()) {
-            new_file << "task,start_time,end_time,elapsed_time,date\n";
+            new_file << "task,start_time,end_time,elapsed_time,date,project,tags\n";
         }
     }
     return tasks;
@@ -57,7 +66,7 @@ std::vector<Task> read_tasks() {
 
 void write_tasks(const std::vector<Task>& tasks) {
     if (std::ofstream file(FILE_PATH); file.is_open()) {
-        file << "task,start_time,end_time,elapsed_time,date\n";
+        file << "task,start_time,end_time,elapsed_time,date,project,tags\n";
         for (const auto& task : tasks) {
             file << task.name << ",";
             file << task.start_time.time_since_epoch().count() << ",";
@@ -66,21 +75,47 @@ void write_tasks(const std::vector<Task>& tasks) {
             } else {
                 file << "0,";
             }
-            file << task.elapsed_seconds << "," << task.date << "\n";
+            file << task.elapsed_seconds << "," << task.date << "," << task.project << ",";
+            for (size_t i = 0; i < task.tags.size(); ++i) {
+                file << (i ? ";" : "") << task.tags[i];
+            }
+            file << "\n";
         }
     }
 }
 
-bool start_task(std::string_view task_name) {
+StartResult start_task(std::string_view task_spec) {
     auto tasks = read_tasks();
 
     if (auto it = std::find_if(tasks.begin(), tasks.end(), [](const auto& task) { return task.running; }); it != tasks.end()) {
-        return false; // A task is already running
+        return StartResult::AlreadyRunning;
     }
 
+    std::string task_name, project;
+    std::vector<std::string> tags;
+    if (std::any_of(tasks.begin(), tasks.end(), [&](const auto& task) { return task.name == task_spec; })) {
+        // An exact existing name wins, so "fix issue #42" saved before tags existed still restarts as is
+        task_name = task_spec;
+    } else {
+        // Split "write report #client-x #billing @client-x/website" into name, tags and project
+        std::stringstream spec{std::string(task_spec)};
+        for (std::string word; spec >> word;) {
+            if (word.size() > 1 && word[0] == '#') {
+                if (!is_valid_tag(word.substr(1))) return StartResult::InvalidTag;
+                if (std::find(tags.begin(), tags.end(), word.substr(1)) == tags.end()) tags.push_back(word.substr(1));
+            } else if (word.size() > 1 && word[0] == '@') {
+                if (!is_valid_project(word.substr(1))) return StartResult::InvalidTag;
+                project = word.substr(1);
+            } else {
+                task_name += (task_name.empty() ? "" : " ") + word;
+            }
+        }
+    }
+    if (task_name.empty()) return StartResult::MissingName;
+
     if (auto it = std::find_if(tasks.begin(), tasks.end(), [&](const auto& task) { return task.name == task_name; }); it != tasks.end()) {
         // Found an existing task
-        if (it->running) return false; // Already running, should not happen due to the check above but good for safety
+        if (it->running) return StartResult::AlreadyRunning; // Already running, should not happen due to the check above but good for safety
         it->start_time = std::chrono::system_clock::now();
         it->running = true;
         // Update date when restarting
@@ -89,6 +124,11 @@ bool start_task(std::string_view task_name) {
         std::stringstream ss;
         ss << std::put_time(std::localtime(&in_time_t), "%Y-%m-%d");
         it->date = ss.str();
+        // Restarting may add tags or move the task to another project
+        if (!project.empty()) it->project = project;
+        for (const auto& tag : tags) {
+            if (std::find(it->tags.begin(), it->tags.end(), tag) == it->tags.end()) it->tags.push_back(tag);
+        }
     } else {
         // Create a new task
         Task new_task;
@@ -102,12 +142,14 @@ bool start_task(std::string_view task_name) {
         std::stringstream ss;
         ss << std::put_time(std::localtime(&in_time_t), "%Y-%m-%d");
         new_task.date = ss.str();
+        new_task.project = project;
+        new_task.tags = tags;
         
         tasks.push_back(new_task);
     }
 
     write_tasks(tasks);
-    return true;
+    return StartResult::Started;
 }
 
 void stop_task(std::string_view task_name) {
@@ -121,33 +163,98 @@ void stop_task(std::string_view task_name) {
     }
 }
 
-void show_status(WINDOW* win) {
+void StatusView::reload() {
+    tasks = read_tasks();
+    index.reset();
+    apply_filter();
+}
+
+void StatusView::set_filter(std::string_view expr) {
+    filter = expr;
+    apply_filter();
+}
+
+void StatusView::apply_filter() {
+    error.clear();
+    matches.clear();
+    if (filter.empty()) {
+        matches.resize(tasks.size());
+        std::iota(matches.begin(), matches.end(), 0u);
+    } else {
+        if (!index) index.emplace(tasks);
+        if (auto result = index->filter(filter, &error)) {
+            matches = result->to_vector();
+        }
+    }
+
+    matched_elapsed = 0;
+    matched_running.clear();
+    for (uint32_t id : matches) {
+        matched_elapsed += tasks[id].elapsed_seconds;
+        if (tasks[id].running) matched_running.push_back(id);
+    }
+}
+
+void show_status(WINDOW* win, const StatusView& view) {
     // Erasing and refreshing is handled by the TUI loop
-    std::vector<Task> tasks = read_tasks();
+    int max_rows = getmaxy(win) - 1; // Keep the bottom border
+    int max_width = getmaxx(win) - 4;
+    char line_buf[512];
+
+    snprintf(line_buf, sizeof(line_buf), "%-20s %-10s %-12s %-12s %-20s %s", "Task", "Status", "Date", "Elapsed Time", "Project", "Tags");
+    mvwaddnstr(win, 1, 2, line_buf, max_width);
+    mvwhline(win, 2, 2, '-', max_width);
 
-    mvwprintw(win, 1, 2, "%-20s %-10s %-12s %-15s", "Task", "Status", "Date", "Elapsed Time");
-    mvwprintw(win, 2, 2, "-----------------------------------------------------------------");
+    if (!view.error.empty()) {
+        std::string title = "[ Invalid filter: " + view.error + " ]";
+        mvwaddnstr(win, 0, 12, title.c_str(), max_width - 10);
+        return;
+    }
 
+    auto now = std::chrono::system_clock::now();
     int row = 3;
-    for (const auto& task : tasks) {
+    for (size_t i = 0; i < view.matches.size() && row < max_rows; ++i, ++row) {
+        const Task& task = view.tasks[view.matches[i]];
         long long total_elapsed = task.elapsed_seconds;
         if (task.running) {
-            total_elapsed += std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now() - task.start_time).count();
+            total_elapsed += std::chrono::duration_cast<std::chrono::seconds>(now - task.start_time).count();
         }
 
         long long hours = total_elapsed / 3600;
         long long minutes = (total_elapsed % 3600) / 60;
         long long seconds = total_elapsed % 60;
 
-        char time_buf[10];
-        sprintf(time_buf, "%02lld:%02lld:%02lld", hours, minutes, seconds);
+        char time_buf[32];
+        snprintf(time_buf, sizeof(time_buf), "%02lld:%02lld:%02lld", hours, minutes, seconds);
+
+        std::string tags;
+        for (const auto& tag : task.tags) {
+            tags += (tags.empty() ? "#" : " #") + tag;
+        }
+
+        snprintf(line_buf, sizeof(line_buf), "%-20s %-10s %-12s %-12s %-20s %s",
+                 task.name.c_str(),
+                 (task.running ? "Running" : "Stopped"),
+                 task.date.c_str(),
+                 time_buf,
+                 task.project.c_str(),
+                 tags.c_str());
+        mvwaddnstr(win, row, 2, line_buf, max_width);
+    }
+
+    if (!view.filter.empty()) {
+        // Only running tasks need live time on top of the cached total
+        long long filtered_elapsed = view.matched_elapsed;
+        for (uint32_t id : view.matched_running) {
+            filtered_elapsed += std::chrono::duration_cast<std::chrono::seconds>(now - view.tasks[id].start_time).count();
+        }
 
-        mvwprintw(win, row, 2, "%-20s %-10s %-12s %-15s",
-                  task.name.c_str(),
-                  (task.running ? "Running" : "Stopped"),
-                  task.date.c_str(),
-                  time_buf);
-        row++;
+        char title[256];
+        snprintf(title, sizeof(title), "[ %.*s: %zu tasks, %02lld:%02lld:%02lld ]",
+                 (int)std::min<size_t>(view.filter.size(), 120), view.filter.data(),
+                 view.matches.size(),
+                 filtered_elapsed / 3600, (filtered_elapsed % 3600) / 60, filtered_elapsed % 60);
+        mvwaddnstr(win, 0, 12, title, max_width - 10);
     }
 }
 
@@ -4,26 +4,45 @@
 #include <string>
 #include <string_view>
 #include <vector>
-#include <chrono>
+#include <optional>
 #include <ncurses.h> // For WINDOW type
+#include "task.h"
+#include "tag_index.h"
 
-struct Task {
-    std::string name;
-    std::chrono::system_clock::time_point start_time;
-    std::chrono::system_clock::time_point end_time;
-    long long elapsed_seconds;
-    bool running;
-    std::string date;
+// Tasks as last read from disk plus the filter result derived from them. The
+// TUI keeps one across redraws and calls reload() only after it changes the
+// CSV, so a redraw never re-parses the file or rebuilds the tag index.
+struct StatusView {
+    std::vector<Task> tasks;
+    std::string filter;             // Empty shows every task
+    std::string error;              // Set when the filter failed to parse
+    std::vector<uint32_t> matches;  // Ids of the tasks passing the filter
+    long long matched_elapsed = 0;  // elapsed_seconds summed over matches
+    std::vector<uint32_t> matched_running;
+
+    void reload();
+    void set_filter(std::string_view expr);
+
+private:
+    std::optional<TagIndex> index; // Built on the first non-empty filter after a reload
+    void apply_filter();
 };
 
 // Core data functions
 std::vector<Task> read_tasks();
 void write_tasks(const std::vector<Task>& tasks);
 
+enum class StartResult {
+    Started,
+    AlreadyRunning, // Another task has to be stopped first
+    MissingName,    // The input only held tags and/or a project
+    InvalidTag      // A tag or project failed is_valid_tag / is_valid_project
+};
+
 // Application logic modified for ncurses
-bool start_task(std::string_view task_name);
+StartResult start_task(std::string_view task_spec); // "name #tag @project/path"
 void stop_task(std::string_view task_name);
-void show_status(WINDOW* win); // Draws status to an ncurses window
+void show_status(WINDOW* win, const StatusView& view); // Draws the view's matching tasks to an ncurses window
 void clear_data();             // Performs the data deletion
 
 #endif // MAIN_H
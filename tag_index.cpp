@@ -0,0 +1,404 @@
+#include "tag_index.h"
+#include "task.h"
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <iterator>
+
+namespace {
+
+constexpr uint32_t CHUNK_BITS = 65536;
+constexpr size_t DENSE_WORDS = CHUNK_BITS / 64;
+constexpr size_t ARRAY_LIMIT = 4096; // Past this a bitset (8KB) is smaller than the array
+
+enum class Op { And, Or, AndNot };
+
+size_t trailing_zeros(uint64_t word) {
+    return std::bitset<64>((word & (~word + 1)) - 1).count();
+}
+
+bool test_bit(const std::vector<uint64_t>& bits, uint16_t low) {
+    return (bits[low / 64] >> (low % 64)) & 1;
+}
+
+} // namespace
+
+void Bitmap::Chunk::to_dense() {
+    bits.assign(DENSE_WORDS, 0);
+    for (uint16_t low : array) {
+        bits[low / 64] |= uint64_t(1) << (low % 64);
+    }
+    array.clear();
+    array.shrink_to_fit();
+}
+
+void Bitmap::Chunk::normalize() {
+    if (is_dense()) {
+        count = 0;
+        for (uint64_t word : bits) {
+            count += std::bitset<64>(word).count();
+        }
+        if (count <= ARRAY_LIMIT) {
+            array.reserve(count);
+            for (size_t w = 0; w < DENSE_WORDS; ++w) {
+                for (uint64_t word = bits[w]; word != 0; word &= word - 1) {
+                    array.push_back(uint16_t(w * 64 + trailing_zeros(word)));
+                }
+            }
+            bits.clear();
+            bits.shrink_to_fit();
+        }
+    } else {
+        count = array.size();
+        if (count > ARRAY_LIMIT) {
+            to_dense();
+        }
+    }
+}
+
+Bitmap Bitmap::range(uint32_t count) {
+    Bitmap result;
+    for (uint64_t base = 0; base < count; base += CHUNK_BITS) {
+        Chunk chunk;
+        chunk.key = uint16_t(base >> 16);
+        uint32_t n = uint32_t(std::min<uint64_t>(CHUNK_BITS, count - base));
+        if (n <= ARRAY_LIMIT) {
+            chunk.array.resize(n);
+            for (uint32_t i = 0; i < n; ++i) chunk.array[i] = uint16_t(i);
+        } else {
+            chunk.bits.assign(DENSE_WORDS, 0);
+            std::fill(chunk.bits.begin(), chunk.bits.begin() + n / 64, ~uint64_t(0));
+            if (n % 64) chunk.bits[n / 64] = (uint64_t(1) << (n % 64)) - 1;
+        }
+        chunk.count = n;
+        result.chunks.push_back(std::move(chunk));
+    }
+    return result;
+}
+
+void Bitmap::add(uint32_t id) {
+    uint16_t key = uint16_t(id >> 16);
+    uint16_t low = uint16_t(id & 0xFFFF);
+
+    auto it = std::lower_bound(chunks.begin(), chunks.end(), key, [](const Chunk& c, uint16_t k) { return c.key < k; });
+    if (it == chunks.end() || it->key != key) {
+        Chunk chunk;
+        chunk.key = key;
+        it = chunks.insert(it, std::move(chunk));
+    }
+
+    if (it->is_dense()) {
+        uint64_t& word = it->bits[low / 64];
+        uint64_t mask = uint64_t(1) << (low % 64);
+        if (!(word & mask)) {
+            word |= mask;
+            it->count++;
+        }
+    } else {
+        // Ids are usually added in ascending order, so check the tail first
+        if (it->array.empty() || it->array.back() < low) {
+            it->array.push_back(low);
+        } else if (auto pos = std::lower_bound(it->array.begin(), it->array.end(), low); *pos != low) {
+            it->array.insert(pos, low);
+        } else {
+            return;
+        }
+        if (++it->count > ARRAY_LIMIT) it->to_dense();
+    }
+}
+
+uint64_t Bitmap::cardinality() const {
+    uint64_t total = 0;
+    for (const auto& chunk : chunks) total += chunk.count;
+    return total;
+}
+
+std::vector<uint32_t> Bitmap::to_vector() const {
+    std::vector<uint32_t> ids;
+    ids.reserve(cardinality());
+    for (const auto& chunk : chunks) {
+        uint32_t base = uint32_t(chunk.key) << 16;
+        if (chunk.is_dense()) {
+            for (size_t w = 0; w < DENSE_WORDS; ++w) {
+                for (uint64_t word = chunk.bits[w]; word != 0; word &= word - 1) {
+                    ids.push_back(base + uint32_t(w * 64 + trailing_zeros(word)));
+                }
+            }
+        } else {
+            for (uint16_t low : chunk.array) ids.push_back(base + low);
+        }
+    }
+    return ids;
+}
+
+namespace {
+
+// Combines two chunks with the same key. Array/array pairs use sorted-set
+// algorithms, an array against a bitset probes the bitset, and anything else
+// falls back to word-wise operations on two bitsets.
+template <typename ChunkT>
+ChunkT combine_chunks(const ChunkT& a, const ChunkT& b, Op op) {
+    ChunkT result;
+    result.key = a.key;
+
+    if (!a.is_dense() && !b.is_dense()) {
+        auto out = std::back_inserter(result.array);
+        switch (op) {
+            case Op::And:    std::set_intersection(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), out); break;
+            case Op::Or:     std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), out); break;
+            case Op::AndNot: std::set_difference(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), out); break;
+        }
+    } else if (op == Op::And && (!a.is_dense() || !b.is_dense())) {
+        const ChunkT& sparse = a.is_dense() ? b : a;
+        const ChunkT& dense = a.is_dense() ? a : b;
+        for (uint16_t low : sparse.array) {
+            if (test_bit(dense.bits, low)) result.array.push_back(low);
+        }
+    } else if (op == Op::AndNot && !a.is_dense()) {
+        for (uint16_t low : a.array) {
+            if (!test_bit(b.bits, low)) result.array.push_back(low);
+        }
+    } else {
+        ChunkT lhs = a;
+        ChunkT rhs = b;
+        if (!lhs.is_dense()) lhs.to_dense();
+        if (!rhs.is_dense()) rhs.to_dense();
+        result.bits = std::move(lhs.bits);
+        for (size_t w = 0; w < DENSE_WORDS; ++w) {
+            switch (op) {
+                case Op::And:    result.bits[w] &= rhs.bits[w]; break;
+                case Op::Or:     result.bits[w] |= rhs.bits[w]; break;
+                case Op::AndNot: result.bits[w] &= ~rhs.bits[w]; break;
+            }
+        }
+    }
+
+    result.normalize();
+    return result;
+}
+
+} // namespace
+
+Bitmap Bitmap::operator&(const Bitmap& other) const {
+    Bitmap result;
+    auto a = chunks.begin(), b = other.chunks.begin();
+    while (a != chunks.end() && b != other.chunks.end()) {
+        if (a->key < b->key) {
+            ++a;
+        } else if (b->key < a->key) {
+            ++b;
+        } else {
+            if (auto chunk = combine_chunks(*a, *b, Op::And); chunk.count > 0) {
+                result.chunks.push_back(std::move(chunk));
+            }
+            ++a;
+            ++b;
+        }
+    }
+    return result;
+}
+
+Bitmap Bitmap::operator|(const Bitmap& other) const {
+    Bitmap result;
+    auto a = chunks.begin(), b = other.chunks.begin();
+    while (a != chunks.end() || b != other.chunks.end()) {
+        if (b == other.chunks.end() || (a != chunks.end() && a->key < b->key)) {
+            result.chunks.push_back(*a++);
+        } else if (a == chunks.end() || b->key < a->key) {
+            result.chunks.push_back(*b++);
+        } else {
+            result.chunks.push_back(combine_chunks(*a, *b, Op::Or));
+            ++a;
+            ++b;
+        }
+    }
+    return result;
+}
+
+Bitmap Bitmap::and_not(const Bitmap& other) const {
+    Bitmap result;
+    auto b = other.chunks.begin();
+    for (const auto& chunk : chunks) {
+        while (b != other.chunks.end() && b->key < chunk.key) ++b;
+        if (b == other.chunks.end() || b->key != chunk.key) {
+            result.chunks.push_back(chunk);
+        } else if (auto diff = combine_chunks(chunk, *b, Op::AndNot); diff.count > 0) {
+            result.chunks.push_back(std::move(diff));
+        }
+    }
+    return result;
+}
+
+TagIndex::TagIndex(const std::vector<Task>& tasks) : universe(Bitmap::range(uint32_t(tasks.size()))) {
+    for (uint32_t id = 0; id < tasks.size(); ++id) {
+        const Task& task = tasks[id];
+        for (const auto& tag : task.tags) {
+            bitmaps[tag].add(id);
+        }
+
+        // "client-x/website" is indexed under both "client-x" and "client-x/website"
+        for (size_t slash = task.project.find('/'); slash != std::string::npos; slash = task.project.find('/', slash + 1)) {
+            if (slash > 0) bitmaps[task.project.substr(0, slash)].add(id);
+        }
+        if (!task.project.empty()) {
+            bitmaps[task.project].add(id);
+        }
+    }
+}
+
+const Bitmap* TagIndex::find(std::string_view key) const {
+    if (auto it = bitmaps.find(key); it != bitmaps.end()) {
+        return &it->second;
+    }
+    return nullptr;
+}
+
+namespace {
+
+bool is_keyword(std::string_view token, std::string_view keyword) {
+    return token.size() == keyword.size() &&
+           std::equal(token.begin(), token.end(), keyword.begin(),
+                      [](char a, char b) { return std::toupper((unsigned char)a) == b; });
+}
+
+bool is_operator(std::string_view token) {
+    return is_keyword(token, "AND") || is_keyword(token, "OR") || is_keyword(token, "NOT");
+}
+
+// Recursive-descent evaluator for:
+//   or_expr  := and_expr (OR and_expr)*
+//   and_expr := unary (AND unary)*
+//   unary    := NOT* primary
+//   primary  := term | '(' or_expr ')'
+// Negated operands inside an AND chain are applied with and_not, so the
+// complement of a tag is only materialised when nothing positive is present.
+class FilterParser {
+public:
+    FilterParser(const TagIndex& index, std::string_view expr) : index(index) {
+        size_t i = 0;
+        while (i < expr.size()) {
+            if (std::isspace((unsigned char)expr[i])) {
+                ++i;
+            } else if (expr[i] == '(' || expr[i] == ')') {
+                tokens.push_back(expr.substr(i, 1));
+                ++i;
+            } else {
+                size_t start = i;
+                while (i < expr.size() && !std::isspace((unsigned char)expr[i]) && expr[i] != '(' && expr[i] != ')') ++i;
+                tokens.push_back(expr.substr(start, i - start));
+            }
+        }
+    }
+
+    std::optional<Bitmap> parse() {
+        if (tokens.empty()) return index.all();
+        auto result = parse_or();
+        if (result && pos < tokens.size()) {
+            return fail("unexpected '" + std::string(tokens[pos]) + "'");
+        }
+        return result;
+    }
+
+    std::string error;
+
+private:
+    const TagIndex& index;
+    std::vector<std::string_view> tokens;
+    size_t pos = 0;
+
+    bool accept(std::string_view keyword) {
+        if (pos < tokens.size() && is_keyword(tokens[pos], keyword)) {
+            ++pos;
+            return true;
+        }
+        return false;
+    }
+
+    std::nullopt_t fail(std::string message) {
+        if (error.empty()) error = std::move(message);
+        return std::nullopt;
+    }
+
+    std::optional<Bitmap> parse_or() {
+        auto result = parse_and();
+        while (result && accept("OR")) {
+            auto rhs = parse_and();
+            if (!rhs) return std::nullopt;
+            result = *result | *rhs;
+        }
+        return result;
+    }
+
+    std::optional<Bitmap> parse_and() {
+        std::optional<Bitmap> positive;
+        std::vector<Bitmap> negatives;
+        do {
+            bool negated = false;
+            while (accept("NOT")) negated = !negated;
+
+            auto operand = parse_primary();
+            if (!operand) return std::nullopt;
+            if (negated) {
+                negatives.push_back(std::move(*operand));
+            } else {
+                positive = positive ? *positive & *operand : std::move(*operand);
+            }
+        } while (accept("AND"));
+
+        Bitmap result = positive ? std::move(*positive) : index.all();
+        for (const auto& negative : negatives) {
+            result = result.and_not(negative);
+        }
+        return result;
+    }
+
+    std::optional<Bitmap> parse_primary() {
+        if (pos >= tokens.size()) {
+            return fail("expected a tag or project");
+        }
+        std::string_view token = tokens[pos];
+        if (token == "(") {
+            ++pos;
+            auto result = parse_or();
+            if (!result) return std::nullopt;
+            if (pos >= tokens.size() || tokens[pos] != ")") {
+                return fail("missing ')'");
+            }
+            ++pos;
+            return result;
+        }
+        if (token == ")" || is_operator(token)) {
+            return fail("unexpected '" + std::string(token) + "'");
+        }
+        ++pos;
+        if (const Bitmap* bitmap = index.find(token)) {
+            return *bitmap;
+        }
+        return Bitmap{};
+    }
+};
+
+} // namespace
+
+bool is_valid_tag(std::string_view tag) {
+    return !tag.empty() && tag.find_first_of(",;()") == std::string_view::npos && !is_operator(tag);
+}
+
+bool is_valid_project(std::string_view project) {
+    for (size_t start = 0;;) {
+        size_t slash = project.find('/', start);
+        // Empty segments ("/x", "x/", "a//b") would index prefixes like "x/" next to "x"
+        if (!is_valid_tag(project.substr(start, slash - start))) return false;
+        if (slash == std::string_view::npos) return true;
+        start = slash + 1;
+    }
+}
+
+std::optional<Bitmap> TagIndex::filter(std::string_view expr, std::string* error) const {
+    FilterParser parser(*this, expr);
+    auto result = parser.parse();
+    if (!result && error) {
+        *error = parser.error;
+    }
+    return result;
+}
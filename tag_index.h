@@ -0,0 +1,70 @@
+#ifndef TAG_INDEX_H
+#define TAG_INDEX_H
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Task;
+
+// Compressed bitmap over 32-bit task ids, laid out like a roaring bitmap:
+// ids are grouped into chunks of 65536 by their high 16 bits, sparse chunks
+// keep a sorted array of the low halves and dense chunks switch to a bitset.
+class Bitmap {
+public:
+    static Bitmap range(uint32_t count); // Every id in [0, count)
+
+    void add(uint32_t id);
+    uint64_t cardinality() const;
+    std::vector<uint32_t> to_vector() const;
+
+    Bitmap operator&(const Bitmap& other) const;
+    Bitmap operator|(const Bitmap& other) const;
+    Bitmap and_not(const Bitmap& other) const;
+
+private:
+    struct Chunk {
+        uint16_t key = 0;
+        uint32_t count = 0;
+        std::vector<uint16_t> array; // Sorted low halves while sparse
+        std::vector<uint64_t> bits;  // 1024 words once dense
+
+        bool is_dense() const { return !bits.empty(); }
+        void to_dense();
+        void normalize();
+    };
+
+    std::vector<Chunk> chunks; // Sorted by key, never holds an empty chunk
+};
+
+// Maps every tag and every project path prefix to the bitmap of task ids
+// (positions in the task vector) carrying it, so filters such as
+// "client-x AND NOT meetings" are answered with bitmap operations.
+class TagIndex {
+public:
+    explicit TagIndex(const std::vector<Task>& tasks);
+
+    const Bitmap& all() const { return universe; }
+    const Bitmap* find(std::string_view key) const;
+
+    // Evaluates a filter built from terms, AND, OR, NOT and parentheses.
+    // An empty expression matches every task. On a syntax error the message
+    // is written to `error` and std::nullopt is returned.
+    std::optional<Bitmap> filter(std::string_view expr, std::string* error = nullptr) const;
+
+private:
+    std::map<std::string, Bitmap, std::less<>> bitmaps;
+    Bitmap universe;
+};
+
+// Tags and project paths must stay selectable by a filter and round-trip
+// through the CSV: no ',', ';', '(' or ')', and no AND/OR/NOT in any case.
+// For projects the rule applies to every '/'-separated segment, and no
+// segment may be empty.
+bool is_valid_tag(std::string_view tag);
+bool is_valid_project(std::string_view project);
+
+#endif // TAG_INDEX_H
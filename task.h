@@ -0,0 +1,19 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include <string>
+#include <vector>
+#include <chrono>
+
+struct Task {
+    std::string name;
+    std::chrono::system_clock::time_point start_time;
+    std::chrono::system_clock::time_point end_time;
+    long long elapsed_seconds;
+    bool running;
+    std::string date;
+    std::string project;           // Slash-separated path, e.g. "client-x/website"
+    std::vector<std::string> tags;
+};
+
+#endif // TASK_H
@@ -178,7 +178,9 @@ std::string get_input(std::string_view prompt) {
     getmaxyx(stdscr, term_y, term_x);
 
     int input_win_h = 3;
-    int input_win_w = std::max(40, (int)prompt.length() + 15); // +15 for input and border
+    int input_win_w = std::max(std::min(40, term_x), term_x - 4); // Task specs and filters need the room
+    // Columns left for the typed text; longer input scrolls so its tail stays visible
+    size_t input_visible_w = std::max(1, input_win_w - 4 - (int)prompt.length());
     WINDOW* input_win = newwin(input_win_h, input_win_w, (term_y - input_win_h) / 2, (term_x - input_win_w) / 2);
     box(input_win, 0, 0);
     keypad(input_win, TRUE);
@@ -193,7 +195,8 @@ std::string get_input(std::string_view prompt) {
         wmove(input_win, 1, 1);
         wclrtoeol(input_win);
         box(input_win, 0, 0); // Redraw box in case it was cleared
-        mvwprintw(input_win, 1, 2, "%s%s", prompt.data(), input_str.c_str());
+        size_t scroll = input_str.length() > input_visible_w ? input_str.length() - input_visible_w : 0;
+        mvwprintw(input_win, 1, 2, "%s%s", prompt.data(), input_str.c_str() + scroll);
         wrefresh(input_win);
 
         ch = wgetch(input_win);
@@ -208,10 +211,7 @@ std::string get_input(std::string_view prompt) {
                 input_str.pop_back();
             }
         } else if (isprint(ch)) {
-            // Ensure input doesn't exceed the visible area within the box
-            if (prompt.length() + input_str.length() < (size_t)input_win_w - 4) {
-                input_str += (char)ch;
-            }
+            input_str += (char)ch;
         }
     }
 
@@ -231,8 +231,10 @@ void run_tui() {
     WINDOW *header_win = nullptr, *status_win = nullptr, *menu_win = nullptr, *timer_win = nullptr;
     draw_layout(header_win, status_win, menu_win, timer_win);
 
-    const std::vector<std::string_view> menu_items = {"Start Task", "Stop Task", "Clear Data", "Exit"};
+    const std::vector<std::string_view> menu_items = {"Start Task", "Stop Task", "Filter Tasks", "Clear Data", "Exit"};
     int current_selection = 0;
+    StatusView status_view; // Filter is e.g. "client-x AND NOT meetings"
+    status_view.reload();
 
     while (true) {
         // --- EFFICIENT REDRAW SECTION ---
@@ -257,7 +259,7 @@ void run_tui() {
 
         box(status_win, 0, 0);
         mvwprintw(status_win, 0, 2, "[ Tasks ]");
-        show_status(status_win); // Ask show_status to fill its window
+        show_status(status_win, status_view); // Ask show_status to fill its window
 
         box(menu_win, 0, 0);
         mvwprintw(menu_win, 0, 2, "[ Menu ]");
@@ -281,9 +283,8 @@ void run_tui() {
         // --- END OF REDRAW SECTION ---
 
         // Timer display logic
-        std::vector<Task> tasks = read_tasks();
-        Task* running_task = nullptr;
-        for (auto& task : tasks) {
+        const Task* running_task = nullptr;
+        for (const auto& task : status_view.tasks) {
             if (task.running) {
                 running_task = &task;
                 break;
@@ -368,8 +369,10 @@ void run_tui() {
                 case 's': // Start Task shortcut
                     if (ch == 's') current_selection = 0;
                     if (current_selection == 0) { // Start Task
-                        if (auto task_name = get_input("Start Task Name: "); !task_name.empty()) {
-                            if (!start_task(task_name)) {
+                        if (auto task_name = get_input("Start Task (name #tag @project): "); !task_name.empty()) {
+                            StartResult result = start_task(task_name);
+                            status_view.reload();
+                            if (result != StartResult::Started) {
                                 int win_h = 7;
                                 int win_w = 62;
                                 WINDOW* warning_win = newwin(win_h, win_w, (LINES - win_h) / 2, (COLS - win_w) / 2);
@@ -377,6 +380,13 @@ void run_tui() {
 
                                 const char* line1 = "A task is already running.";
                                 const char* line2 = "Maybe you would like to stop the previous task first?";
+                                if (result == StartResult::MissingName) {
+                                    line1 = "A task needs a name.";
+                                    line2 = "Tags (#tag) and a project (@path) go after the name.";
+                                } else if (result == StartResult::InvalidTag) {
+                                    line1 = "Tags and projects cannot contain , ; ( or )";
+                                    line2 = "be AND, OR or NOT, or have an empty path part.";
+                                }
                                 const char* button = "< OK >";
 
                                 mvwprintw(warning_win, 2, (win_w - strlen(line1)) / 2, line1);
@@ -409,6 +419,7 @@ void run_tui() {
                             std::string prompt = "Stop task '" + running_task_to_stop->name + "'? (y/n): ";
                             if (get_input(prompt) == "y") {
                                 stop_task(running_task_to_stop->name);
+                                status_view.reload();
                             }
                         } else {
                             // Display a message that no task is running
@@ -428,19 +439,27 @@ void run_tui() {
                         }
                     }
                     // Fallthrough for other shortcuts
+                case 'f': // Filter Tasks shortcut
+                    if (ch == 'f') current_selection = 2;
+                    if (current_selection == 2) { // Filter Tasks
+                        // An empty filter (or Escape) clears it and shows every task again
+                        status_view.set_filter(get_input("Filter (tag AND/OR/NOT ...): "));
+                    }
+                    // Fallthrough for other shortcuts
                 case 'X': // Clear Data shortcut
-                    if (ch == 'X') current_selection = 2;
-                    if (current_selection == 2) { // Clear Data
+                    if (ch == 'X') current_selection = 3;
+                    if (current_selection == 3) { // Clear Data
                         if (get_input("Are you sure? (y/n): ") == "y") {
                             if (get_input("Type 'confirm' to delete all data: ") == "confirm") {
                                 clear_data();
+                                status_view.reload();
                             }
                         }
                     }
                     // Fallthrough for other shortcuts
                 case 'q': // Exit shortcut
-                    if (ch == 'q') current_selection = 3;
-                    if (current_selection == 3) { // Exit
+                    if (ch == 'q') current_selection = 4;
+                    if (current_selection == 4) { // Exit
                         delwin(header_win);
                         delwin(status_win);
                         delwin(menu_win);